@@ -0,0 +1,104 @@
+/*
+* COPYRIGHT © 2024 RIBBON COMMUNICATIONS OPERATING COMPANY, INC. ALL RIGHTS RESERVED.
+* This publication and the information contained herein is the property of Ribbon
+* and may not be copied, reproduced or distributed in any form or by any means without
+* the prior written permission of Ribbon.
+*
+* THIS PUBLICATION IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+* PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+* FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+* OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE PUBLICATION OR ITS USE.
+*
+* SMBinaryLogSink.h
+*
+* @version: 6.44.0
+*
+*/
+
+#import <Foundation/Foundation.h>
+#import "SMLogType.h"
+#import "SMLoggingDelegate.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * @brief Logger which writes log messages to disk in a compact binary format.
+ *
+ * Each record keeps a varint encoded timestamp delta, the log level, indexes into the log context and
+ * method name tables and the message. Log contexts and method names are written once per segment.
+ * Records are written to memory-mapped segment files. When a segment reaches segmentSize a new segment
+ * is started, and the oldest segment is deleted when there are more than maximumSegmentCount segments.
+ *
+ * An instance can be assigned to logger of SMConfiguration directly, or called from the application's own logger.
+ * Segments can be converted to text with decodeSegmentAtURL:error:
+ *
+ * @since 6.45.0
+ */
+__attribute__((objc_runtime_name("SWIFTSMBinaryLogSink")))
+@interface SMBinaryLogSink : NSObject <SMLoggingDelegate>
+
+/**
+ * Directory of the segment files
+ */
+@property (nonatomic, readonly) NSURL *directoryURL;
+
+/**
+ * Maximum size of a segment file in bytes
+ */
+@property (nonatomic, readonly) NSUInteger segmentSize;
+
+/**
+ * Maximum number of segment files kept in the directory
+ */
+@property (nonatomic, readonly) NSUInteger maximumSegmentCount;
+
+/**
+ * Creates a binary log sink
+ *
+ * @param directoryURL directory of the segment files, it is created if it does not exist
+ * @param segmentSize maximum size of a segment file in bytes, values smaller than 65536 are handled as 65536
+ * @param maximumSegmentCount maximum number of segment files kept in the directory, at least 1
+ * @param error definition of failure if the directory can not be used
+ *
+ * @return SMBinaryLogSink instance or nil
+ * @since 6.45.0
+ */
++ (nullable SMBinaryLogSink *) sinkWithDirectoryURL:(NSURL *)directoryURL
+                                        segmentSize:(NSUInteger)segmentSize
+                                maximumSegmentCount:(NSUInteger)maximumSegmentCount
+                                              error:(NSError * _Nullable * _Nullable)error;
+
+/**
+ * Writes the records in memory to the current segment file
+ *
+ * @since 6.45.0
+ */
+- (void) flush;
+
+/**
+ * Returns the segment files from the oldest to the newest
+ *
+ * @return segment file URLs
+ * @since 6.45.0
+ */
+- (NSArray<NSURL *> *) segmentURLs;
+
+/**
+ * Converts a segment file to text, one line per record in the following format:
+ * <time> [<level>] <context-method>: <message>
+ *
+ * @param segmentURL URL of the segment file
+ * @param error definition of failure if the file is not a valid segment
+ *
+ * @return text of the segment or nil
+ * @since 6.45.0
+ */
++ (nullable NSString *) decodeSegmentAtURL:(NSURL *)segmentURL
+                                     error:(NSError * _Nullable * _Nullable)error;
+
+- (instancetype) init __attribute__((unavailable("Use static initializer sinkWithDirectoryURL:segmentSize:maximumSegmentCount:error:")));
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,131 @@
+/*
+* COPYRIGHT © 2024 RIBBON COMMUNICATIONS OPERATING COMPANY, INC. ALL RIGHTS RESERVED.
+* This publication and the information contained herein is the property of Ribbon
+* and may not be copied, reproduced or distributed in any form or by any means without
+* the prior written permission of Ribbon.
+*
+* THIS PUBLICATION IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+* PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+* FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+* OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE PUBLICATION OR ITS USE.
+*
+* SMExternalVideoFrame.h
+*
+* @version: 6.44.0
+*
+*/
+
+#import <Foundation/Foundation.h>
+
+/**
+ * @brief enum class for pixel formats of external video frames
+ *
+ * - PIXEL_FORMAT_NV12
+ * - PIXEL_FORMAT_I420
+ *
+ * @since 6.45.0
+ */
+typedef NS_ENUM(NSInteger, SMExternalVideoPixelFormat) {
+    /** Y plane followed by an interleaved CbCr plane */
+    PIXEL_FORMAT_NV12 NS_SWIFT_NAME(NV12),
+
+    /** Separate Y, Cb and Cr planes */
+    PIXEL_FORMAT_I420 NS_SWIFT_NAME(I420)
+};
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * @brief Planar video frame which is provided by the application as external video source.
+ *
+ * The frame does not copy the given planes. MobileSDK keeps a reference to the planes
+ * until the frame is encoded or dropped and then calls the release handler, so that the
+ * application can reuse the buffer for the next decoded frame.
+ * The release handler is called exactly once, on an internal queue.
+ *
+ * @see [SMCallDelegate sendExternalVideoFrame:]
+ * @since 6.45.0
+ */
+__attribute__((objc_runtime_name("SWIFTSMExternalVideoFrame")))
+@interface SMExternalVideoFrame : NSObject
+
+/**
+ * Pixel format of the frame
+ */
+@property (nonatomic, readonly) SMExternalVideoPixelFormat pixelFormat;
+
+/**
+ * Width of the frame in pixels
+ */
+@property (nonatomic, readonly) int width;
+
+/**
+ * Height of the frame in pixels
+ */
+@property (nonatomic, readonly) int height;
+
+/**
+ * Capture time of the frame in nanoseconds
+ */
+@property (nonatomic, readonly) int64_t timeStampNs;
+
+/**
+ * Creates a frame which wraps NV12 planes
+ *
+ * @param width width of the frame in pixels
+ * @param height height of the frame in pixels
+ * @param dataY Y plane
+ * @param strideY number of bytes per row of the Y plane
+ * @param dataUV interleaved CbCr plane
+ * @param strideUV number of bytes per row of the CbCr plane
+ * @param timeStampNs capture time of the frame in nanoseconds
+ * @param releaseHandler block which is called when MobileSDK no longer uses the planes
+ *
+ * @remark If a stride is smaller than the row size of its plane, a @b nil object will return.
+ * In that case releaseHandler is not called and the planes still belong to the application.
+ * @since 6.45.0
+ */
++ (nullable SMExternalVideoFrame *) NV12FrameWithWidth:(int)width
+                                                height:(int)height
+                                                 dataY:(const uint8_t *)dataY
+                                               strideY:(int)strideY
+                                                dataUV:(const uint8_t *)dataUV
+                                              strideUV:(int)strideUV
+                                           timeStampNs:(int64_t)timeStampNs
+                                        releaseHandler:(void (^)(void))releaseHandler;
+
+/**
+ * Creates a frame which wraps I420 planes
+ *
+ * @param width width of the frame in pixels
+ * @param height height of the frame in pixels
+ * @param dataY Y plane
+ * @param strideY number of bytes per row of the Y plane
+ * @param dataU Cb plane
+ * @param strideU number of bytes per row of the Cb plane
+ * @param dataV Cr plane
+ * @param strideV number of bytes per row of the Cr plane
+ * @param timeStampNs capture time of the frame in nanoseconds
+ * @param releaseHandler block which is called when MobileSDK no longer uses the planes
+ *
+ * @remark If a stride is smaller than the row size of its plane, a @b nil object will return.
+ * In that case releaseHandler is not called and the planes still belong to the application.
+ * @since 6.45.0
+ */
++ (nullable SMExternalVideoFrame *) I420FrameWithWidth:(int)width
+                                                height:(int)height
+                                                 dataY:(const uint8_t *)dataY
+                                               strideY:(int)strideY
+                                                 dataU:(const uint8_t *)dataU
+                                               strideU:(int)strideU
+                                                 dataV:(const uint8_t *)dataV
+                                               strideV:(int)strideV
+                                           timeStampNs:(int64_t)timeStampNs
+                                        releaseHandler:(void (^)(void))releaseHandler;
+
+- (instancetype) init __attribute__((unavailable("Use one of the static create methods")));
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,202 @@
+/*
+* COPYRIGHT © 2024 RIBBON COMMUNICATIONS OPERATING COMPANY, INC. ALL RIGHTS RESERVED.
+* This publication and the information contained herein is the property of Ribbon
+* and may not be copied, reproduced or distributed in any form or by any means without
+* the prior written permission of Ribbon.
+*
+* THIS PUBLICATION IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+* PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+* FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+* OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE PUBLICATION OR ITS USE.
+*
+* SMRTPStatistics.h
+*
+* @version: 6.44.0
+*
+*/
+
+#import <Foundation/Foundation.h>
+
+/**
+ * @brief Field mask which selects the statistics produced by an RTP statistics subscription.
+ * Fields which are not selected are left as zero in the samples.
+ *
+ * @since 6.45.0
+ */
+typedef NS_OPTIONS(NSUInteger, SMRTPStatisticsFields) {
+    /** packetsSent / packetsReceived */
+    RTP_STATS_PACKETS NS_SWIFT_NAME(packets) = 1 << 0,
+
+    /** bytesSent / bytesReceived */
+    RTP_STATS_BYTES NS_SWIFT_NAME(bytes) = 1 << 1,
+
+    /** packetsLost of inbound streams */
+    RTP_STATS_PACKETS_LOST NS_SWIFT_NAME(packetsLost) = 1 << 2,
+
+    /** jitter of inbound streams */
+    RTP_STATS_JITTER NS_SWIFT_NAME(jitter) = 1 << 3,
+
+    /** currentRoundTripTime of candidate pairs */
+    RTP_STATS_ROUND_TRIP_TIME NS_SWIFT_NAME(roundTripTime) = 1 << 4,
+
+    /** frames encoded / decoded, frame size and frames per second of video streams */
+    RTP_STATS_FRAMES NS_SWIFT_NAME(frames) = 1 << 5,
+
+    /** availableOutgoingBitrate / availableIncomingBitrate of candidate pairs */
+    RTP_STATS_AVAILABLE_BITRATE NS_SWIFT_NAME(availableBitrate) = 1 << 6,
+
+    /** All fields */
+    RTP_STATS_ALL NS_SWIFT_NAME(all) = 0x7F
+};
+
+/**
+ * @brief enum class for media kind of an RTP stream
+ *
+ * @since 6.45.0
+ */
+typedef NS_ENUM(uint8_t, SMRTPMediaKind) {
+    /** Audio stream */
+    RTP_MEDIA_AUDIO NS_SWIFT_NAME(audio),
+
+    /** Video stream */
+    RTP_MEDIA_VIDEO NS_SWIFT_NAME(video)
+};
+
+/**
+ * @brief Statistics of an inbound RTP stream.
+ * Counters are delta values since the previous sample, other values are the current values.
+ *
+ * @since 6.45.0
+ */
+typedef struct {
+    /** SSRC of the stream */
+    uint32_t ssrc;
+    /** Media kind of the stream */
+    SMRTPMediaKind kind;
+    /** Received packets (counter) */
+    uint64_t packetsReceived;
+    /** Received bytes (counter) */
+    uint64_t bytesReceived;
+    /** Lost packets (counter), can be negative when duplicated packets are received */
+    int64_t packetsLost;
+    /** Decoded frames (counter) */
+    uint64_t framesDecoded;
+    /** Jitter in seconds */
+    double jitter;
+    /** Width of the last decoded frame */
+    uint32_t frameWidth;
+    /** Height of the last decoded frame */
+    uint32_t frameHeight;
+    /** Decoded frames per second */
+    double framesPerSecond;
+} SMInboundRTPStatistics;
+
+/**
+ * @brief Statistics of an outbound RTP stream.
+ * Counters are delta values since the previous sample, other values are the current values.
+ *
+ * @since 6.45.0
+ */
+typedef struct {
+    /** SSRC of the stream */
+    uint32_t ssrc;
+    /** Media kind of the stream */
+    SMRTPMediaKind kind;
+    /** Sent packets (counter) */
+    uint64_t packetsSent;
+    /** Sent bytes (counter) */
+    uint64_t bytesSent;
+    /** Encoded frames (counter) */
+    uint64_t framesEncoded;
+    /** Width of the last encoded frame */
+    uint32_t frameWidth;
+    /** Height of the last encoded frame */
+    uint32_t frameHeight;
+    /** Encoded frames per second */
+    double framesPerSecond;
+} SMOutboundRTPStatistics;
+
+/**
+ * @brief Statistics of the nominated ICE candidate pair.
+ * Counters are delta values since the previous sample, other values are the current values.
+ *
+ * @since 6.45.0
+ */
+typedef struct {
+    /** Sent packets (counter) */
+    uint64_t packetsSent;
+    /** Received packets (counter) */
+    uint64_t packetsReceived;
+    /** Sent bytes (counter) */
+    uint64_t bytesSent;
+    /** Received bytes (counter) */
+    uint64_t bytesReceived;
+    /** Current round trip time in seconds */
+    double currentRoundTripTime;
+    /** Available outgoing bitrate in bits per second */
+    double availableOutgoingBitrate;
+    /** Available incoming bitrate in bits per second */
+    double availableIncomingBitrate;
+} SMCandidatePairStatistics;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * @brief One sample of an RTP statistics subscription.
+ *
+ * The first sample of a subscription contains totals since the call start, following samples
+ * contain counters as delta values since the previous sample.
+ * The stream arrays are owned by the sample and are valid as long as the sample object is alive.
+ *
+ * @see [SMCallDelegate subscribeRTPStatisticsWithInterval:fields:handler:]
+ * @since 6.45.0
+ */
+__attribute__((objc_runtime_name("SWIFTSMRTPStatisticsSample")))
+@interface SMRTPStatisticsSample : NSObject
+
+/**
+ * Time of the sample (epoch in milliseconds)
+ */
+@property (nonatomic, readonly) int64_t timestamp;
+
+/**
+ * Time since the previous sample in milliseconds. Value is 0 for the first sample.
+ */
+@property (nonatomic, readonly) int64_t interval;
+
+/**
+ * Fields which are produced in this sample
+ */
+@property (nonatomic, readonly) SMRTPStatisticsFields fields;
+
+/**
+ * Number of inbound RTP streams
+ */
+@property (nonatomic, readonly) NSUInteger inboundCount;
+
+/**
+ * Inbound RTP stream statistics, inboundCount elements
+ */
+@property (nonatomic, readonly, nullable) const SMInboundRTPStatistics *inbound NS_RETURNS_INNER_POINTER;
+
+/**
+ * Number of outbound RTP streams
+ */
+@property (nonatomic, readonly) NSUInteger outboundCount;
+
+/**
+ * Outbound RTP stream statistics, outboundCount elements
+ */
+@property (nonatomic, readonly, nullable) const SMOutboundRTPStatistics *outbound NS_RETURNS_INNER_POINTER;
+
+/**
+ * Statistics of the nominated candidate pair
+ */
+@property (nonatomic, readonly) SMCandidatePairStatistics candidatePair;
+
+- (instancetype) init __attribute__((unavailable("Samples are created by MobileSDK")));
+
+@end
+
+NS_ASSUME_NONNULL_END
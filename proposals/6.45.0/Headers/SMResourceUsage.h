@@ -0,0 +1,58 @@
+/*
+* COPYRIGHT © 2024 RIBBON COMMUNICATIONS OPERATING COMPANY, INC. ALL RIGHTS RESERVED.
+* This publication and the information contained herein is the property of Ribbon
+* and may not be copied, reproduced or distributed in any form or by any means without
+* the prior written permission of Ribbon.
+*
+* THIS PUBLICATION IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+* PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+* FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+* OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE PUBLICATION OR ITS USE.
+*
+* SMResourceUsage.h
+*
+* @version: 6.44.0
+*
+*/
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * @brief WebRTC resource usage of the active calls
+ * threadCount, number of threads created by MobileSDK and WebRTC
+ * sharedMemory, bytes used by the resources which are not owned by a single call
+ * callMemory, bytes used by each active call
+ *
+ * @since 6.45.0
+ */
+__attribute__((objc_runtime_name("SWIFTSMResourceUsage")))
+@interface SMResourceUsage : NSObject
+
+/**
+ * @brief Number of threads created by MobileSDK and WebRTC
+ * @since 6.45.0
+ */
+@property (nonatomic, readonly) NSUInteger threadCount;
+
+/**
+ * @brief Bytes used by the resources which are not owned by a single call
+ * These are the peer connection factory, the WebRTC signaling, worker and network threads and the audio device module.
+ * @since 6.45.0
+ */
+@property (nonatomic, readonly) unsigned long long sharedMemory;
+
+/**
+ * @brief Bytes used by each active call, keyed by Id of the call
+ * Includes the peer connection and media tracks of the call.
+ * @since 6.45.0
+ */
+@property (nonatomic, readonly) NSDictionary<NSString *, NSNumber *> * callMemory;
+
+- (instancetype) init __attribute__((unavailable("Resource usage is created by MobileSDK, use getResourceUsage")));
+
+@end
+
+NS_ASSUME_NONNULL_END
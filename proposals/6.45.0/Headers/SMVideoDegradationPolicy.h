@@ -0,0 +1,137 @@
+/*
+* COPYRIGHT © 2024 RIBBON COMMUNICATIONS OPERATING COMPANY, INC. ALL RIGHTS RESERVED.
+* This publication and the information contained herein is the property of Ribbon
+* and may not be copied, reproduced or distributed in any form or by any means without
+* the prior written permission of Ribbon.
+*
+* THIS PUBLICATION IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+* PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+* FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+* OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE PUBLICATION OR ITS USE.
+*
+* SMVideoDegradationPolicy.h
+*
+* @version: 6.44.0
+*
+*/
+
+#import <Foundation/Foundation.h>
+#import <UIKit/UIKit.h>
+
+@class SMVideoQualityLadder;
+@class SMVideoCodec;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * @brief Provides thermal and battery conditions of the device to SMVideoDegradationPolicy.
+ * MobileSDK uses NSProcessInfo and UIDevice when no provider is given. UIDevice reports the battery level and state only
+ * while batteryMonitoringEnabled is YES, so the default provider sets batteryMonitoringEnabled of the current device to YES.
+ * This setting is global to the application and is not set back to NO by MobileSDK.
+ * Applications can provide their own implementation, e.g. to replay a recorded thermal trace in tests.
+ *
+ * @since 6.45.0
+ */
+@protocol SMDeviceConditionsProvider <NSObject>
+
+/**
+ * Current thermal state of the device
+ */
+- (NSProcessInfoThermalState) thermalState;
+
+/**
+ * Current battery level of the device between 0.0 and 1.0, or -1.0 if unknown
+ */
+- (float) batteryLevel;
+
+/**
+ * Current battery state of the device.
+ * The battery level is not used by the policy while the state is UIDeviceBatteryStateCharging or UIDeviceBatteryStateFull.
+ */
+- (UIDeviceBatteryState) batteryState;
+
+/**
+ * Indicates low power mode is enabled
+ */
+- (BOOL) isLowPowerModeEnabled;
+
+@end
+
+/**
+ * @brief Policy which lowers video quality of calls according to thermal state and battery level of the device.
+ *
+ * On each evaluation, the policy moves video of active calls one step down its ladder when the thermal state
+ * is at least minimumThermalState, or when the battery level is below minimumBatteryLevel and the battery state is unplugged, or
+ * when low power mode is enabled. It moves one step up when none of these conditions has been present for
+ * ladder.stepUpDelay seconds. When the thermal state becomes critical, the policy sends a call update for each active
+ * video call with thermalCodecPreference as video codec preference. When the thermal state has been below critical for
+ * ladder.stepUpDelay seconds, the policy sends another call update which restores preferredCodecSet of SMConfiguration.
+ * The application does not need to update the calls itself.
+ * Each decision is reported with the videoDegradation action of callAdditionalInfoChanged.
+ *
+ * @since 6.45.0
+ */
+__attribute__((objc_runtime_name("SWIFTSMVideoDegradationPolicy")))
+@interface SMVideoDegradationPolicy : NSObject
+
+/**
+ * Provider of the device conditions
+ */
+@property (nonatomic, strong, readonly) id<SMDeviceConditionsProvider> conditionsProvider;
+
+/**
+ * Capture resolution and frame rate steps used by the policy.
+ * Ladder of the call is used if it is set with setVideoQualityLadder:completionHandler:
+ */
+@property (nonatomic, strong) SMVideoQualityLadder *ladder;
+
+/**
+ * Thermal state from which video quality is lowered.
+ * Default value is NSProcessInfoThermalStateSerious.
+ */
+@property (nonatomic) NSProcessInfoThermalState minimumThermalState;
+
+/**
+ * Battery level below which video quality is lowered when the device is not charging.
+ * Default value is 0.2.
+ */
+@property (nonatomic) float minimumBatteryLevel;
+
+/**
+ * Video codec preference used when the thermal state is critical.
+ * The policy sends the call update which applies it, and restores preferredCodecSet of SMConfiguration with another call
+ * update when the thermal state has been below critical for ladder.stepUpDelay seconds.
+ * Default value is H264 followed by VP8.
+ */
+@property (nonatomic, strong, nullable) NSArray<SMVideoCodec *> *thermalCodecPreference;
+
+/**
+ * Time between evaluations of the device conditions in seconds.
+ * Default value is 5.
+ */
+@property (nonatomic) NSTimeInterval evaluationInterval;
+
+/**
+ * Creates a policy which reads the device conditions from the system
+ *
+ * @param ladder capture resolution and frame rate steps used by the policy
+ * @since 6.45.0
+ */
++ (SMVideoDegradationPolicy *) policyWithLadder:(SMVideoQualityLadder *)ladder;
+
+/**
+ * Creates a policy which reads the device conditions from the given provider
+ *
+ * @param ladder capture resolution and frame rate steps used by the policy
+ * @param conditionsProvider provider of the device conditions
+ * @since 6.45.0
+ */
++ (SMVideoDegradationPolicy *) policyWithLadder:(SMVideoQualityLadder *)ladder
+                             conditionsProvider:(id<SMDeviceConditionsProvider>)conditionsProvider;
+
+- (instancetype) init __attribute__((unavailable("Use static initializer policyWithLadder:")));
+
+@end
+
+NS_ASSUME_NONNULL_END
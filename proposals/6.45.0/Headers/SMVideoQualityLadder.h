@@ -0,0 +1,165 @@
+/*
+* COPYRIGHT © 2024 RIBBON COMMUNICATIONS OPERATING COMPANY, INC. ALL RIGHTS RESERVED.
+* This publication and the information contained herein is the property of Ribbon
+* and may not be copied, reproduced or distributed in any form or by any means without
+* the prior written permission of Ribbon.
+*
+* THIS PUBLICATION IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+* PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+* FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+* OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE PUBLICATION OR ITS USE.
+*
+* SMVideoQualityLadder.h
+*
+* @version: 6.44.0
+*
+*/
+
+#import <Foundation/Foundation.h>
+
+/**
+ * @brief enum class for degradation preferences of a video quality ladder
+ *
+ * The steps of a ladder are always used in the order of the ladder. The degradation preference is set as the
+ * degradation preference of the video sender, and defines how WebRTC adapts the video within the current step
+ * until MobileSDK moves to the next step.
+ *
+ * - MAINTAIN_FRAMERATE
+ * - MAINTAIN_RESOLUTION
+ * - BALANCED
+ *
+ * @since 6.45.0
+ */
+typedef NS_ENUM(NSInteger, SMDegradationPreference) {
+    /** Within a step, resolution is lowered first and frame rate is kept as long as possible */
+    MAINTAIN_FRAMERATE NS_SWIFT_NAME(maintainFramerate),
+
+    /** Within a step, frame rate is lowered first and resolution is kept as long as possible */
+    MAINTAIN_RESOLUTION NS_SWIFT_NAME(maintainResolution),
+
+    /** Within a step, resolution and frame rate are lowered together */
+    BALANCED NS_SWIFT_NAME(balanced)
+};
+
+/**
+ * @brief enum class for reasons of a video quality step change
+ *
+ * @since 6.45.0
+ */
+typedef NS_ENUM(NSInteger, SMVideoQualityChangeReason) {
+    /** Encoder CPU usage is too high or has recovered */
+    VIDEO_QUALITY_REASON_CPU NS_SWIFT_NAME(cpu),
+
+    /** Available bandwidth is too low or has recovered */
+    VIDEO_QUALITY_REASON_BANDWIDTH NS_SWIFT_NAME(bandwidth),
+
+    /** Thermal state of the device is high or has recovered, see SMVideoDegradationPolicy */
+    VIDEO_QUALITY_REASON_THERMAL NS_SWIFT_NAME(thermal),
+
+    /** Battery level of the device is low or has recovered, see SMVideoDegradationPolicy */
+    VIDEO_QUALITY_REASON_BATTERY NS_SWIFT_NAME(battery)
+};
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * @brief Represents one step of a video quality ladder
+ *
+ * @since 6.45.0
+ */
+__attribute__((objc_runtime_name("SWIFTSMVideoQualityStep")))
+@interface SMVideoQualityStep : NSObject
+
+/**
+ * Width of the encoded video in pixels
+ */
+@property (nonatomic, readonly) int width;
+
+/**
+ * Height of the encoded video in pixels
+ */
+@property (nonatomic, readonly) int height;
+
+/**
+ * Frames per second of the encoded video
+ */
+@property (nonatomic, readonly) int fps;
+
+/**
+ * Creates a video quality step
+ *
+ * @param width width of the encoded video in pixels
+ * @param height height of the encoded video in pixels
+ * @param fps frames per second of the encoded video
+ *
+ * @remark If a value is not positive, a @b nil object will return.
+ * @since 6.45.0
+ */
++ (nullable SMVideoQualityStep *) stepWithWidth:(int)width height:(int)height fps:(int)fps;
+
+- (instancetype) init __attribute__((unavailable("Use static initializer stepWithWidth:height:fps:")));
+
+@end
+
+/**
+ * @brief Video quality ladder of a call
+ *
+ * The ladder defines the encoder resolution and frame rate steps used when the call is limited by CPU or bandwidth.
+ * MobileSDK moves one step down when the limitation lasts longer than stepDownDelay, and one step up when
+ * the limitation has been cleared for longer than stepUpDelay. The steps are used in the order of the ladder;
+ * the width, height and fps of the current step are the upper limits of the encoder, and a shorter limitation is
+ * handled by WebRTC within these limits according to degradationPreference.
+ *
+ * @code
+ * SMVideoQualityLadder *ladder = [SMVideoQualityLadder ladderWithSteps:@[
+ *     [SMVideoQualityStep stepWithWidth:1280 height:720 fps:30],
+ *     [SMVideoQualityStep stepWithWidth:960 height:540 fps:30],
+ *     [SMVideoQualityStep stepWithWidth:640 height:360 fps:15]]
+ *                                           degradationPreference:BALANCED];
+ * @endcode
+ *
+ * @since 6.45.0
+ */
+__attribute__((objc_runtime_name("SWIFTSMVideoQualityLadder")))
+@interface SMVideoQualityLadder : NSObject
+
+/**
+ * Steps of the ladder from the highest to the lowest quality
+ */
+@property (nonatomic, readonly) NSArray<SMVideoQualityStep *> *steps;
+
+/**
+ * Degradation preference of the video sender within the current step
+ */
+@property (nonatomic, readonly) SMDegradationPreference degradationPreference;
+
+/**
+ * Time in seconds that a limitation should last before moving one step down.
+ * Default value is 2.
+ */
+@property (nonatomic) NSTimeInterval stepDownDelay;
+
+/**
+ * Time in seconds without limitation before moving one step up.
+ * Default value is 10.
+ */
+@property (nonatomic) NSTimeInterval stepUpDelay;
+
+/**
+ * Creates a video quality ladder
+ *
+ * @param steps steps of the ladder from the highest to the lowest quality
+ * @param degradationPreference degradation preference of the video sender within the current step
+ *
+ * @remark If steps is empty, a @b nil object will return.
+ * @since 6.45.0
+ */
++ (nullable SMVideoQualityLadder *) ladderWithSteps:(NSArray<SMVideoQualityStep *> *)steps
+                              degradationPreference:(SMDegradationPreference)degradationPreference;
+
+- (instancetype) init __attribute__((unavailable("Use static initializer ladderWithSteps:degradationPreference:")));
+
+@end
+
+NS_ASSUME_NONNULL_END